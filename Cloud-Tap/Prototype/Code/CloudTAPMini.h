@@ -4,7 +4,8 @@
 #include <iostream>
 #include <string>
 #include <vector>
-#include "DeviceBST.h"
+#include "DeviceIndex.h"
+#include "DeviceIndexBenchmark.h"
 #include "NetworkGraph.h"
 #include "EventLogger.h"
 #include "ConnectionStack.h"
@@ -18,7 +19,7 @@ using namespace std;
 
 class CloudTAPMini {
 private:
-    DeviceBST deviceTree;
+    DeviceIndex deviceTree;
     NetworkGraph topology;
     EventLogger logger;
     ConnectionStack connHistory;
@@ -30,7 +31,7 @@ public:
     }
     
     void initializeNetwork() {
-        // Add devices to BST
+        // Add devices to index
         deviceTree.addDevice("CORE-R1", "Core Router", "192.168.1.1", "Core");
         deviceTree.addDevice("FW-1", "Firewall", "192.168.100.1", "Security");
         deviceTree.addDevice("MGMT-SW1", "Management Switch", "10.10.10.254", "Management");
@@ -67,7 +68,7 @@ public:
         getline(cin, deviceId);
         
         // Check if device already exists
-        BSTNode* existing = deviceTree.findDevice(deviceId);
+        DeviceRecord* existing = deviceTree.findDevice(deviceId);
         if (existing) {
             cout << "\nError: Device ID already exists!\n";
             logger.addLog(1, "Failed to add device: " + deviceId + " (duplicate ID)");
@@ -94,7 +95,7 @@ public:
         cout << "Enter Department (e.g., IT, Sales, Management): ";
         getline(cin, department);
         
-        // Add device to BST
+        // Add device to index
         deviceTree.addDevice(deviceId, deviceName, ipAddress, department);
         
         cout << "\nDevice added successfully!\n";
@@ -129,7 +130,7 @@ public:
             getline(cin, targetDevice);
             
             // Check if target device exists
-            BSTNode* target = deviceTree.findDevice(targetDevice);
+            DeviceRecord* target = deviceTree.findDevice(targetDevice);
             if (!target) {
                 cout << "Warning: Device " << targetDevice << " not found. Skipping...\n";
                 continue;
@@ -149,11 +150,20 @@ public:
     
     void searchDevice() {
         cout << "\n=== DEVICE SEARCH ===\n";
-        cout << "Enter Device ID: ";
+        cout << "Enter Device ID (or prefix ending in *, e.g. IT-*): ";
         string id;
         cin >> id;
         
-        BSTNode* device = deviceTree.findDevice(id);
+        if (!id.empty() && id[id.size() - 1] == '*') {
+            string prefix = id.substr(0, id.size() - 1);
+            vector<DeviceRecord*> matches = deviceTree.prefixScan(prefix);
+            cout << "\n" << matches.size() << " device(s) matching " << id << ":\n";
+            deviceTree.displayRecords(matches);
+            logger.addLog(0, "Device prefix search: " + id);
+            return;
+        }
+        
+        DeviceRecord* device = deviceTree.findDevice(id);
         if (device) {
             cout << "\nDevice Found!\n";
             cout << "  ID: " << device->deviceId << "\n";
@@ -189,6 +199,19 @@ public:
                 cout << "  Hop " << (i+1) << ": " << path[i] << "\n";
             }
             
+            // Backup routes (Yen's k-shortest paths by latency), minus the hop path above
+            vector<NetworkGraph::Path> routes = topology.kShortestPaths(src, dst, 3);
+            int backups = 0;
+            for (size_t r = 0; r < routes.size(); r++) {
+                if (routes[r].nodes == path) continue;
+                if (backups == 0) cout << "\nBackup routes:\n";
+                cout << "  " << ++backups << ". ";
+                for (size_t i = 0; i < routes[r].nodes.size(); i++) {
+                    cout << routes[r].nodes[i] << (i + 1 < routes[r].nodes.size() ? " -> " : "");
+                }
+                cout << " (" << routes[r].cost << " ms)\n";
+            }
+            
             string conn = src + " -> " + dst;
             connHistory.push(conn);
             logger.addLog(0, "Traceroute: " + conn);
@@ -200,16 +223,36 @@ public:
         cout << "Source Device: ";
         string src;
         cin >> src;
-        cout << "Destination Device: ";
+        cout << "Destination Device (or ALL): ";
         string dst;
         cin >> dst;
         
-        int latency = topology.dijkstra(src, dst);
+        if (dst == "ALL") {
+            // One single-source pass answers every destination
+            const vector<string>& targets = topology.nodes();
+            vector<int> latencies = topology.latenciesFrom(src, targets);
+            cout << "\nLatency from " << src << ":\n";
+            for (size_t i = 0; i < targets.size(); i++) {
+                if (targets[i] == src) continue;
+                cout << "  " << targets[i] << ": ";
+                if (latencies[i] == -1) cout << "unreachable\n";
+                else cout << latencies[i] << " ms\n";
+            }
+            logger.addLog(0, "Latency check: " + src + " -> ALL");
+            return;
+        }
+        
+        vector<string> path;
+        int latency = topology.aStar(src, dst, &path);
         
         if (latency == -1) {
             cout << "\nNo route found!\n";
         } else {
             cout << "\nOptimal path latency: " << latency << " ms\n";
+            cout << "Path: ";
+            for (size_t i = 0; i < path.size(); i++) {
+                cout << path[i] << (i + 1 < path.size() ? " -> " : "\n");
+            }
             logger.addLog(0, "Latency check: " + src + " -> " + dst);
         }
     }
@@ -275,6 +318,7 @@ public:
             cout << "8. DHCP Manager\n";
             cout << "9. Connection History\n";
             cout << "10. System Event Logs\n";
+            cout << "11. Device Index Benchmark\n";
             cout << "0. Exit\n";
             cout << "============================================\n";
             cout << "Choice: ";
@@ -317,6 +361,10 @@ public:
                 case 10:
                     logger.displayLogs(15);
                     break;
+                case 11:
+                    runDeviceIndexBenchmark();
+                    logger.addLog(0, "Device index benchmark run");
+                    break;
                 default:
                     cout << "\nInvalid choice!\n";
                     logger.addLog(1, "Invalid menu choice");
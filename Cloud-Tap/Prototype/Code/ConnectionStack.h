@@ -3,45 +3,30 @@
 
 #include <iostream>
 #include <string>
-#include <stack>
+#include "RingBuffer.h"
 using namespace std;
 
 // ============================================================================
 // STACK FOR CONNECTION HISTORY
 // ============================================================================
+// Bounded LIFO view over a ring buffer: once full, a push overwrites the
+// oldest entry in place.
 
 class ConnectionStack {
 private:
-    stack<string> history;
-    int maxSize;
+    RingBuffer<string> history;
     
 public:
-    ConnectionStack(int size = 20) : maxSize(size) {}
+    ConnectionStack(int size = 20) : history(size) {}
     
     void push(string connection) {
-        if ((int)history.size() >= maxSize) {
-            // Remove oldest (bottom of stack)
-            stack<string> temp;
-            while ((int)history.size() > 1) {
-                temp.push(history.top());
-                history.pop();
-            }
-            history.pop(); // Remove oldest
-            while (!temp.empty()) {
-                history.push(temp.top());
-                temp.pop();
-            }
-        }
         history.push(connection);
     }
     
     void display() {
         cout << "\n=== CONNECTION HISTORY ===\n";
-        stack<string> temp = history;
-        int count = 1;
-        while (!temp.empty()) {
-            cout << count++ << ". " << temp.top() << "\n";
-            temp.pop();
+        for (int i = 0; i < history.size(); i++) {
+            cout << (i + 1) << ". " << history.recent(i) << "\n";
         }
     }
 };
@@ -3,11 +3,14 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 using namespace std;
 
 // ============================================================================
 // BINARY SEARCH TREE FOR DEVICE MANAGEMENT
 // ============================================================================
+// Unbalanced baseline, superseded by DeviceIndex. Kept for the comparison in
+// DeviceIndexBenchmark.h.
 
 struct BSTNode {
     string deviceId;
@@ -67,9 +70,26 @@ private:
         inorder(node->right);
     }
     
+    // Owns its nodes, so copies would delete them twice (declared, never defined)
+    DeviceBST(const DeviceBST&);
+    DeviceBST& operator=(const DeviceBST&);
+    
 public:
     DeviceBST() { root = NULL; }
     
+    ~DeviceBST() {
+        // Iterative so a degenerate (list-shaped) tree cannot overflow the stack
+        vector<BSTNode*> pending;
+        if (root != NULL) pending.push_back(root);
+        while (!pending.empty()) {
+            BSTNode* node = pending.back();
+            pending.pop_back();
+            if (node->left != NULL) pending.push_back(node->left);
+            if (node->right != NULL) pending.push_back(node->right);
+            delete node;
+        }
+    }
+    
     void addDevice(string id, string name, string ip, string dept) {
         root = insert(root, id, name, ip, dept);
     }
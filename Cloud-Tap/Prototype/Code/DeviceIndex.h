@@ -0,0 +1,441 @@
+#ifndef DEVICE_INDEX_H
+#define DEVICE_INDEX_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <deque>
+using namespace std;
+
+// ============================================================================
+// B+ TREE FOR DEVICE MANAGEMENT
+// ============================================================================
+// All leaves sit at the same depth, so lookup, insert and delete are
+// O(log n) whatever order IDs arrive in. Leaves are chained left to right
+// for ordered, range and prefix scans. Nodes and records come from pools
+// owned by the index; freed slots are reused and everything is released
+// with the index.
+
+struct DeviceRecord {
+    string deviceId;
+    string deviceName;
+    string ipAddress;
+    string department;
+    bool isOnline;
+};
+
+class DeviceIndex {
+private:
+    static const int ORDER = 32;            // max keys per node
+    static const int MIN_KEYS = ORDER / 2;  // min keys per non-root node
+
+    // Leaves hold keys inline (no record lookup while searching) plus record
+    // slots; one spare slot absorbs overflow before a split
+    struct Leaf {
+        int count;
+        string keys[ORDER + 1];
+        int rec[ORDER + 1];
+        int prev;
+        int next;
+    };
+
+    // sep[i] is the smallest key reachable through child[i + 1]
+    struct Inner {
+        int count;
+        string sep[ORDER + 1];
+        int child[ORDER + 2];
+    };
+
+    deque<DeviceRecord> records;  // deque keeps DeviceRecord* stable as it grows
+    vector<int> freeRecords;
+    vector<Leaf> leaves;
+    vector<int> freeLeaves;
+    vector<Inner> inners;
+    vector<int> freeInners;
+
+    int root;       // leaf index when height == 0, otherwise inner index
+    int height;     // number of inner levels above the leaves
+    int firstLeaf;
+    int deviceCount;
+
+    vector<pair<int, int> > path; // (inner, child position) from root to leaf
+
+    int allocRecord(const string& id, const string& name, const string& ip, const string& dept) {
+        int slot;
+        if (!freeRecords.empty()) {
+            slot = freeRecords.back();
+            freeRecords.pop_back();
+        } else {
+            slot = (int)records.size();
+            records.push_back(DeviceRecord());
+        }
+        DeviceRecord& r = records[slot];
+        r.deviceId = id;
+        r.deviceName = name;
+        r.ipAddress = ip;
+        r.department = dept;
+        r.isOnline = true;
+        return slot;
+    }
+
+    int allocLeaf() {
+        int idx;
+        if (!freeLeaves.empty()) {
+            idx = freeLeaves.back();
+            freeLeaves.pop_back();
+        } else {
+            idx = (int)leaves.size();
+            leaves.push_back(Leaf());
+        }
+        leaves[idx].count = 0;
+        leaves[idx].prev = -1;
+        leaves[idx].next = -1;
+        return idx;
+    }
+
+    int allocInner() {
+        int idx;
+        if (!freeInners.empty()) {
+            idx = freeInners.back();
+            freeInners.pop_back();
+        } else {
+            idx = (int)inners.size();
+            inners.push_back(Inner());
+        }
+        inners[idx].count = 0;
+        return idx;
+    }
+
+    // First position in leaf whose key is >= id
+    int leafLowerBound(const Leaf& leaf, const string& id) const {
+        int lo = 0, hi = leaf.count;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (leaf.keys[mid] < id) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo;
+    }
+
+    // Child to follow: number of separators <= id
+    int innerChild(const Inner& node, const string& id) const {
+        int lo = 0, hi = node.count;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (!(id < node.sep[mid])) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo;
+    }
+
+    // Walk to the leaf that would hold id, recording the path when asked
+    int findLeaf(const string& id, bool recordPath) {
+        if (recordPath) path.clear();
+        int node = root;
+        for (int level = 0; level < height; level++) {
+            int pos = innerChild(inners[node], id);
+            if (recordPath) path.push_back(make_pair(node, pos));
+            node = inners[node].child[pos];
+        }
+        return node;
+    }
+
+    int findLeafConst(const string& id) const {
+        int node = root;
+        for (int level = 0; level < height; level++) {
+            node = inners[node].child[innerChild(inners[node], id)];
+        }
+        return node;
+    }
+
+    void removeFromParent(int parent, int sepPos) {
+        Inner& p = inners[parent];
+        for (int i = sepPos; i + 1 < p.count; i++) p.sep[i] = p.sep[i + 1];
+        for (int i = sepPos + 1; i < p.count; i++) p.child[i] = p.child[i + 1];
+        p.count--;
+    }
+
+    // Restore MIN_KEYS in a leaf by borrowing from or merging with a sibling
+    void fixLeafUnderflow(int leafIdx, int parent, int pos) {
+        Inner& p = inners[parent];
+        int left = pos > 0 ? p.child[pos - 1] : -1;
+        int right = pos < p.count ? p.child[pos + 1] : -1;
+        Leaf& leaf = leaves[leafIdx];
+
+        if (left != -1 && leaves[left].count > MIN_KEYS) {
+            Leaf& l = leaves[left];
+            for (int i = leaf.count; i > 0; i--) {
+                leaf.keys[i] = leaf.keys[i - 1];
+                leaf.rec[i] = leaf.rec[i - 1];
+            }
+            l.count--;
+            leaf.keys[0] = l.keys[l.count];
+            leaf.rec[0] = l.rec[l.count];
+            leaf.count++;
+            p.sep[pos - 1] = leaf.keys[0];
+            return;
+        }
+        if (right != -1 && leaves[right].count > MIN_KEYS) {
+            Leaf& r = leaves[right];
+            leaf.keys[leaf.count] = r.keys[0];
+            leaf.rec[leaf.count] = r.rec[0];
+            leaf.count++;
+            for (int i = 0; i + 1 < r.count; i++) {
+                r.keys[i] = r.keys[i + 1];
+                r.rec[i] = r.rec[i + 1];
+            }
+            r.count--;
+            p.sep[pos] = r.keys[0];
+            return;
+        }
+
+        // Merge the right node of the pair into the left one
+        int into = left != -1 ? left : leafIdx;
+        int from = left != -1 ? leafIdx : right;
+        Leaf& a = leaves[into];
+        Leaf& b = leaves[from];
+        for (int i = 0; i < b.count; i++) {
+            a.keys[a.count] = b.keys[i];
+            a.rec[a.count] = b.rec[i];
+            a.count++;
+        }
+        a.next = b.next;
+        if (b.next != -1) leaves[b.next].prev = into;
+        freeLeaves.push_back(from);
+        removeFromParent(parent, left != -1 ? pos - 1 : pos);
+    }
+
+    // Restore MIN_KEYS in an inner node by rotating through or merging with a sibling
+    void fixInnerUnderflow(int nodeIdx, int parent, int pos) {
+        Inner& p = inners[parent];
+        int left = pos > 0 ? p.child[pos - 1] : -1;
+        int right = pos < p.count ? p.child[pos + 1] : -1;
+        Inner& n = inners[nodeIdx];
+
+        if (left != -1 && inners[left].count > MIN_KEYS) {
+            Inner& l = inners[left];
+            for (int i = n.count; i > 0; i--) n.sep[i] = n.sep[i - 1];
+            for (int i = n.count + 1; i > 0; i--) n.child[i] = n.child[i - 1];
+            n.sep[0] = p.sep[pos - 1];
+            n.child[0] = l.child[l.count];
+            p.sep[pos - 1] = l.sep[l.count - 1];
+            l.count--;
+            n.count++;
+            return;
+        }
+        if (right != -1 && inners[right].count > MIN_KEYS) {
+            Inner& r = inners[right];
+            n.sep[n.count] = p.sep[pos];
+            n.child[n.count + 1] = r.child[0];
+            p.sep[pos] = r.sep[0];
+            for (int i = 0; i + 1 < r.count; i++) r.sep[i] = r.sep[i + 1];
+            for (int i = 0; i < r.count; i++) r.child[i] = r.child[i + 1];
+            r.count--;
+            n.count++;
+            return;
+        }
+
+        int sepPos = left != -1 ? pos - 1 : pos;
+        int into = left != -1 ? left : nodeIdx;
+        int from = left != -1 ? nodeIdx : right;
+        Inner& a = inners[into];
+        Inner& b = inners[from];
+        a.sep[a.count] = p.sep[sepPos];
+        for (int i = 0; i < b.count; i++) a.sep[a.count + 1 + i] = b.sep[i];
+        for (int i = 0; i <= b.count; i++) a.child[a.count + 1 + i] = b.child[i];
+        a.count += 1 + b.count;
+        freeInners.push_back(from);
+        removeFromParent(parent, sepPos);
+    }
+
+    void printRecord(const DeviceRecord& r) const {
+        cout << "  [" << r.deviceId << "] " << r.deviceName
+             << " | IP: " << r.ipAddress
+             << " | Dept: " << r.department
+             << " | Status: " << (r.isOnline ? "ONLINE" : "OFFLINE") << "\n";
+    }
+
+public:
+    DeviceIndex() : height(0), deviceCount(0) {
+        root = allocLeaf();
+        firstLeaf = root;
+    }
+
+    int size() const { return deviceCount; }
+
+    // Returns false if the ID is already present
+    bool addDevice(const string& id, const string& name, const string& ip, const string& dept) {
+        int leafIdx = findLeaf(id, true);
+        int pos = leafLowerBound(leaves[leafIdx], id);
+        if (pos < leaves[leafIdx].count && leaves[leafIdx].keys[pos] == id) return false;
+
+        int slot = allocRecord(id, name, ip, dept);
+        deviceCount++;
+
+        Leaf& leaf = leaves[leafIdx];
+        for (int i = leaf.count; i > pos; i--) {
+            leaf.keys[i] = leaf.keys[i - 1];
+            leaf.rec[i] = leaf.rec[i - 1];
+        }
+        leaf.keys[pos] = id;
+        leaf.rec[pos] = slot;
+        leaf.count++;
+        if (leaf.count <= ORDER) return true;
+
+        // Split leaf: upper half moves to a new right sibling
+        int rightIdx = allocLeaf();
+        Leaf& full = leaves[leafIdx];
+        Leaf& right = leaves[rightIdx];
+        int keep = (ORDER + 1) / 2;
+        right.count = full.count - keep;
+        for (int i = 0; i < right.count; i++) {
+            right.keys[i] = full.keys[keep + i];
+            right.rec[i] = full.rec[keep + i];
+        }
+        full.count = keep;
+        right.prev = leafIdx;
+        right.next = full.next;
+        if (full.next != -1) leaves[full.next].prev = rightIdx;
+        full.next = rightIdx;
+
+        string upKey = right.keys[0];
+        int upChild = rightIdx;
+
+        // Propagate the split towards the root
+        while (!path.empty()) {
+            int parent = path.back().first;
+            int cpos = path.back().second;
+            path.pop_back();
+
+            Inner& p = inners[parent];
+            for (int i = p.count; i > cpos; i--) p.sep[i] = p.sep[i - 1];
+            for (int i = p.count + 1; i > cpos + 1; i--) p.child[i] = p.child[i - 1];
+            p.sep[cpos] = upKey;
+            p.child[cpos + 1] = upChild;
+            p.count++;
+            if (p.count <= ORDER) return true;
+
+            int newIdx = allocInner();
+            Inner& left = inners[parent];
+            Inner& sib = inners[newIdx];
+            int mid = left.count / 2;
+            upKey = left.sep[mid];
+            sib.count = left.count - mid - 1;
+            for (int i = 0; i < sib.count; i++) sib.sep[i] = left.sep[mid + 1 + i];
+            for (int i = 0; i <= sib.count; i++) sib.child[i] = left.child[mid + 1 + i];
+            left.count = mid;
+            upChild = newIdx;
+        }
+
+        // Root split: tree grows one level
+        int newRoot = allocInner();
+        Inner& r = inners[newRoot];
+        r.count = 1;
+        r.sep[0] = upKey;
+        r.child[0] = root;
+        r.child[1] = upChild;
+        root = newRoot;
+        height++;
+        return true;
+    }
+
+    DeviceRecord* findDevice(const string& id) {
+        const Leaf& leaf = leaves[findLeafConst(id)];
+        int pos = leafLowerBound(leaf, id);
+        if (pos < leaf.count && leaf.keys[pos] == id) return &records[leaf.rec[pos]];
+        return NULL;
+    }
+
+    // Returns false if the ID is not present
+    bool removeDevice(const string& id) {
+        int leafIdx = findLeaf(id, true);
+        Leaf& leaf = leaves[leafIdx];
+        int pos = leafLowerBound(leaf, id);
+        if (pos >= leaf.count || leaf.keys[pos] != id) return false;
+
+        freeRecords.push_back(leaf.rec[pos]);
+        for (int i = pos; i + 1 < leaf.count; i++) {
+            leaf.keys[i] = leaf.keys[i + 1];
+            leaf.rec[i] = leaf.rec[i + 1];
+        }
+        leaf.count--;
+        deviceCount--;
+
+        if (height == 0 || leaf.count >= MIN_KEYS) return true;
+
+        fixLeafUnderflow(leafIdx, path.back().first, path.back().second);
+
+        // Underflow may cascade up through the inner levels
+        while (!path.empty()) {
+            int node = path.back().first;
+            path.pop_back();
+            if (inners[node].count >= MIN_KEYS) return true;
+            if (path.empty()) break;
+            fixInnerUnderflow(node, path.back().first, path.back().second);
+        }
+
+        // Collapse a root left with a single child
+        if (height > 0 && inners[root].count == 0) {
+            freeInners.push_back(root);
+            root = inners[root].child[0];
+            height--;
+        }
+        return true;
+    }
+
+    // Devices with lo <= id < hi, in ID order
+    vector<DeviceRecord*> rangeScan(const string& lo, const string& hi) {
+        vector<DeviceRecord*> result;
+        int leafIdx = findLeafConst(lo);
+        int pos = leafLowerBound(leaves[leafIdx], lo);
+        while (leafIdx != -1) {
+            const Leaf& leaf = leaves[leafIdx];
+            for (; pos < leaf.count; pos++) {
+                if (!(leaf.keys[pos] < hi)) return result;
+                result.push_back(&records[leaf.rec[pos]]);
+            }
+            leafIdx = leaf.next;
+            pos = 0;
+        }
+        return result;
+    }
+
+    // Devices whose ID starts with prefix (e.g. "IT-"), in ID order
+    vector<DeviceRecord*> prefixScan(const string& prefix) {
+        vector<DeviceRecord*> result;
+        int leafIdx = findLeafConst(prefix);
+        int pos = leafLowerBound(leaves[leafIdx], prefix);
+        while (leafIdx != -1) {
+            const Leaf& leaf = leaves[leafIdx];
+            for (; pos < leaf.count; pos++) {
+                if (leaf.keys[pos].compare(0, prefix.size(), prefix) != 0) return result;
+                result.push_back(&records[leaf.rec[pos]]);
+            }
+            leafIdx = leaf.next;
+            pos = 0;
+        }
+        return result;
+    }
+
+    void displayAll() const {
+        if (deviceCount == 0) {
+            cout << "No devices in network.\n";
+            return;
+        }
+        cout << "\n=== ALL NETWORK DEVICES ===\n";
+        for (int leafIdx = firstLeaf; leafIdx != -1; leafIdx = leaves[leafIdx].next) {
+            const Leaf& leaf = leaves[leafIdx];
+            for (int i = 0; i < leaf.count; i++) {
+                printRecord(records[leaf.rec[i]]);
+            }
+        }
+    }
+
+    void displayRecords(const vector<DeviceRecord*>& list) const {
+        for (size_t i = 0; i < list.size(); i++) {
+            printRecord(*list[i]);
+        }
+    }
+};
+
+#endif // DEVICE_INDEX_H
@@ -0,0 +1,117 @@
+#ifndef DEVICE_INDEX_BENCHMARK_H
+#define DEVICE_INDEX_BENCHMARK_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include "DeviceBST.h"
+#include "DeviceIndex.h"
+using namespace std;
+
+// ============================================================================
+// BENCHMARK: DeviceIndex (B+ tree) vs DeviceBST (unbalanced)
+// ============================================================================
+
+const int BENCH_DEVICES = 1000000;
+// Sorted input turns DeviceBST into a linked list: O(n^2) inserts and one
+// recursion frame per node, so the sorted BST run stops at this size.
+const int BENCH_BST_SORTED_LIMIT = 2000;
+
+inline double benchElapsedMs(clock_t start) {
+    return 1000.0 * (clock() - start) / CLOCKS_PER_SEC;
+}
+
+inline void benchReport(const string& label, int ops, double ms) {
+    printf("  %-34s %9d ops %10.1f ms %9.1f ns/op\n", label.c_str(), ops, ms,
+           ops > 0 ? ms * 1000000.0 / ops : 0.0);
+}
+
+inline vector<string> benchDeviceIds(int count, bool shuffled) {
+    vector<string> ids(count);
+    char buf[16];
+    for (int i = 0; i < count; i++) {
+        sprintf(buf, "DEV-%07d", i);
+        ids[i] = buf;
+    }
+    if (shuffled) {
+        // Fixed-seed LCG so every run sees the same order
+        unsigned long long state = 12345;
+        for (int i = count - 1; i > 0; i--) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            int j = (int)((state >> 33) % (unsigned long long)(i + 1));
+            swap(ids[i], ids[j]);
+        }
+    }
+    return ids;
+}
+
+inline void benchBST(const string& label, const vector<string>& ids, int count) {
+    DeviceBST tree;
+    clock_t start = clock();
+    for (int i = 0; i < count; i++) {
+        tree.addDevice(ids[i], "", "", "");
+    }
+    benchReport(label + " insert", count, benchElapsedMs(start));
+
+    start = clock();
+    int found = 0;
+    for (int i = 0; i < count; i++) {
+        if (tree.findDevice(ids[i]) != NULL) found++;
+    }
+    benchReport(label + " lookup", found, benchElapsedMs(start));
+}
+
+inline void benchIndex(const string& label, const vector<string>& ids, int count, bool scans) {
+    DeviceIndex index;
+    clock_t start = clock();
+    for (int i = 0; i < count; i++) {
+        index.addDevice(ids[i], "", "", "");
+    }
+    benchReport(label + " insert", count, benchElapsedMs(start));
+
+    start = clock();
+    int found = 0;
+    for (int i = 0; i < count; i++) {
+        if (index.findDevice(ids[i]) != NULL) found++;
+    }
+    benchReport(label + " lookup", found, benchElapsedMs(start));
+
+    if (!scans) return;
+
+    start = clock();
+    int matched = 0;
+    for (int i = 0; i < 1000; i++) {
+        matched += (int)index.prefixScan(ids[i].substr(0, 9)).size();
+    }
+    benchReport(label + " prefix scan (x1000)", matched, benchElapsedMs(start));
+
+    start = clock();
+    int removed = 0;
+    for (int i = 0; i < count; i++) {
+        if (index.removeDevice(ids[i])) removed++;
+    }
+    benchReport(label + " delete", removed, benchElapsedMs(start));
+}
+
+inline void runDeviceIndexBenchmark() {
+    cout << "\n=== DEVICE INDEX BENCHMARK (" << BENCH_DEVICES << " devices) ===\n";
+    cout << "Running, this can take a few seconds...\n";
+
+    vector<string> randomIds = benchDeviceIds(BENCH_DEVICES, true);
+    cout << "\nRandom-order IDs:\n";
+    benchBST("DeviceBST", randomIds, BENCH_DEVICES);
+    benchIndex("DeviceIndex", randomIds, BENCH_DEVICES, true);
+
+    vector<string> sortedIds = benchDeviceIds(BENCH_DEVICES, false);
+    cout << "\nSorted IDs (like IT-PC1, IT-PC2, ...):\n";
+    benchBST("DeviceBST", sortedIds, BENCH_BST_SORTED_LIMIT);
+    benchIndex("DeviceIndex", sortedIds, BENCH_BST_SORTED_LIMIT, false);
+    benchIndex("DeviceIndex", sortedIds, BENCH_DEVICES, true);
+    cout << "  (DeviceBST capped at " << BENCH_BST_SORTED_LIMIT
+         << " sorted inserts: it degenerates to a list)\n";
+}
+
+#endif // DEVICE_INDEX_BENCHMARK_H
@@ -3,12 +3,12 @@
 
 #include <iostream>
 #include <string>
-#include <queue>
 #include <ctime>
+#include "SeverityIndex.h"
 using namespace std;
 
 // ============================================================================
-// PRIORITY QUEUE FOR EVENT LOGGING
+// SEVERITY INDEX FOR EVENT LOGGING
 // ============================================================================
 
 struct LogEntry {
@@ -16,56 +16,43 @@ struct LogEntry {
     string message;
     string timestamp;
     
+    LogEntry() : severity(0) {}
     LogEntry(int s, string m, string t) : severity(s), message(m), timestamp(t) {}
-    
-    bool operator<(const LogEntry& other) const {
-        return severity < other.severity; // Max heap
-    }
 };
 
 class EventLogger {
 private:
-    priority_queue<LogEntry> logs;
-    int maxSize;
+    // Keeps the last maxSize events; each insert is O(1)
+    SeverityIndex<LogEntry> logs;
     
 public:
-    EventLogger(int size = 50) : maxSize(size) {}
+    EventLogger(int size = 50) : logs(size, 4) {}
     
     void addLog(int severity, string message) {
         time_t now = time(0);
         char buf[80];
         strftime(buf, sizeof(buf), "%H:%M:%S", localtime(&now));
         
-        logs.push(LogEntry(severity, message, string(buf)));
-        
-        // Keep only recent logs
-        if ((int)logs.size() > maxSize) {
-            priority_queue<LogEntry> temp;
-            for (int i = 0; i < maxSize; i++) {
-                temp.push(logs.top());
-                logs.pop();
-            }
-            logs = temp;
-        }
+        logs.push(severity, LogEntry(severity, message, string(buf)));
     }
     
     void displayLogs(int count = 10) {
         cout << "\n=== RECENT SYSTEM EVENTS (Top " << count << ") ===\n";
-        priority_queue<LogEntry> temp = logs;
+        SeverityIndex<LogEntry>::Cursor cursor = logs.top();
         
-        for (int i = 0; i < count && !temp.empty(); i++) {
-            LogEntry entry = temp.top();
-            temp.pop();
+        for (int i = 0; i < count; i++) {
+            const LogEntry* entry = cursor.next();
+            if (entry == NULL) break;
             
             string severityStr;
-            switch(entry.severity) {
+            switch(entry->severity) {
                 case 0: severityStr = "[INFO]"; break;
                 case 1: severityStr = "[WARN]"; break;
                 case 2: severityStr = "[ERROR]"; break;
                 case 3: severityStr = "[CRITICAL]"; break;
             }
             
-            cout << entry.timestamp << " " << severityStr << " " << entry.message << "\n";
+            cout << entry->timestamp << " " << severityStr << " " << entry->message << "\n";
         }
     }
 };
@@ -0,0 +1,107 @@
+#ifndef INDEXED_HEAP_H
+#define INDEXED_HEAP_H
+
+#include <vector>
+using namespace std;
+
+// ============================================================================
+// INDEXED D-ARY MIN-HEAP (PRIORITY QUEUE WITH DECREASE-KEY)
+// ============================================================================
+// Items are integer handles in [0, capacity). Each handle is in the heap at
+// most once, so Dijkstra updates a key in place instead of pushing duplicates.
+
+template <typename KeyT, int D = 4>
+class IndexedHeap {
+private:
+    vector<int> heap;      // heap slot -> handle
+    vector<int> position;  // handle -> heap slot, -1 if absent
+    vector<KeyT> keys;     // handle -> current key
+
+    void place(int slot, int handle) {
+        heap[slot] = handle;
+        position[handle] = slot;
+    }
+
+    void siftUp(int slot) {
+        int handle = heap[slot];
+        while (slot > 0) {
+            int parent = (slot - 1) / D;
+            if (!(keys[handle] < keys[heap[parent]])) break;
+            place(slot, heap[parent]);
+            slot = parent;
+        }
+        place(slot, handle);
+    }
+
+    void siftDown(int slot) {
+        int size = (int)heap.size();
+        int handle = heap[slot];
+        while (true) {
+            int first = slot * D + 1;
+            if (first >= size) break;
+            int last = first + D < size ? first + D : size;
+            int best = first;
+            for (int c = first + 1; c < last; c++) {
+                if (keys[heap[c]] < keys[heap[best]]) best = c;
+            }
+            if (!(keys[heap[best]] < keys[handle])) break;
+            place(slot, heap[best]);
+            slot = best;
+        }
+        place(slot, handle);
+    }
+
+public:
+    IndexedHeap(int capacity = 0) {
+        reset(capacity);
+    }
+
+    // Resize for a new handle range and empty the heap
+    void reset(int capacity) {
+        heap.clear();
+        position.assign(capacity, -1);
+        keys.resize(capacity);
+    }
+
+    // Empty the heap in O(size) without touching the whole handle range
+    void clear() {
+        for (size_t i = 0; i < heap.size(); i++) {
+            position[heap[i]] = -1;
+        }
+        heap.clear();
+    }
+
+    bool empty() const { return heap.empty(); }
+    int size() const { return (int)heap.size(); }
+    int capacity() const { return (int)position.size(); }
+    bool contains(int handle) const { return position[handle] != -1; }
+
+    int topHandle() const { return heap[0]; }
+    KeyT topKey() const { return keys[heap[0]]; }
+
+    // Insert handle, or lower its key if already present with a larger one
+    void pushOrDecrease(int handle, KeyT key) {
+        if (position[handle] == -1) {
+            keys[handle] = key;
+            heap.push_back(handle);
+            siftUp((int)heap.size() - 1);
+        } else if (key < keys[handle]) {
+            keys[handle] = key;
+            siftUp(position[handle]);
+        }
+    }
+
+    int pop() {
+        int top = heap[0];
+        int last = heap.back();
+        heap.pop_back();
+        position[top] = -1;
+        if (!heap.empty()) {
+            place(0, last);
+            siftDown(0);
+        }
+        return top;
+    }
+};
+
+#endif // INDEXED_HEAP_H
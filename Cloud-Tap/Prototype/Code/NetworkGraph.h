@@ -4,133 +4,488 @@
 #include <iostream>
 #include <string>
 #include <vector>
-#include <queue>
 #include <map>
 #include <set>
+#include <limits>
 #include <algorithm>
+#include "IndexedHeap.h"
 using namespace std;
 
 // ============================================================================
 // GRAPH FOR NETWORK TOPOLOGY
 // ============================================================================
+// Nodes are mapped once to integer handles; adjacency and all per-query state
+// live in flat vectors indexed by handle. Scratch arrays are reused between
+// queries and invalidated with an epoch stamp instead of being reallocated.
 
-struct Edge {
-    string target;
-    int weight;
-    
-    Edge(string t, int w) : target(t), weight(w) {}
-};
+template <typename NodeT, typename WeightT>
+class BasicNetworkGraph {
+public:
+    typedef int NodeHandle;
+
+    struct Edge {
+        NodeHandle target;
+        WeightT weight;
+
+        Edge(NodeHandle t, WeightT w) : target(t), weight(w) {}
+    };
+
+    struct Path {
+        WeightT cost;
+        vector<NodeT> nodes;
+    };
+
+    static const int LANDMARK_COUNT = 4;
 
-class NetworkGraph {
 private:
-    map<string, vector<Edge> > adjList;
-    
-public:
-    void addEdge(string from, string to, int weight = 1) {
-        adjList[from].push_back(Edge(to, weight));
-        adjList[to].push_back(Edge(from, weight));
-    }
-    
-    // BFS - Find shortest path
-    vector<string> bfsPath(string start, string end) {
-        map<string, bool> visited;
-        map<string, string> parent;
-        queue<string> q;
-        
-        q.push(start);
-        visited[start] = true;
-        parent[start] = "";
-        
-        while (!q.empty()) {
-            string current = q.front();
-            q.pop();
-            
-            if (current == end) {
-                // Reconstruct path
-                vector<string> path;
-                string node = end;
-                while (node != "") {
-                    path.push_back(node);
-                    node = parent[node];
+    vector<NodeT> nodeKeys;               // handle -> node
+    map<NodeT, NodeHandle> handleIndex;   // node -> handle
+    vector<vector<Edge> > adjList;        // handle -> edges
+
+    // Per-query scratch (forward search)
+    vector<unsigned> stamp;
+    vector<WeightT> dist;
+    vector<NodeHandle> parent;
+    IndexedHeap<WeightT> heap;
+    unsigned epoch;
+
+    // Per-query scratch (backward search of bidirectional Dijkstra)
+    vector<unsigned> stampB;
+    vector<WeightT> distB;
+    vector<NodeHandle> parentB;
+    IndexedHeap<WeightT> heapB;
+
+    // Nodes/edges excluded from the search (Yen's spur paths)
+    vector<unsigned> bannedStamp;
+    vector<NodeHandle> bannedSpurEdges;
+    NodeHandle bannedSpurNode;
+
+    // ALT heuristic: exact distances from a few landmark nodes
+    vector<vector<WeightT> > landmarkDist;
+    bool landmarksDirty;
+
+    vector<NodeHandle> frontier;
+
+    static WeightT infinity() { return numeric_limits<WeightT>::max(); }
+
+    NodeHandle handleOf(const NodeT& node) const {
+        typename map<NodeT, NodeHandle>::const_iterator it = handleIndex.find(node);
+        return it == handleIndex.end() ? -1 : it->second;
+    }
+
+    NodeHandle addNode(const NodeT& node) {
+        NodeHandle h = handleOf(node);
+        if (h != -1) return h;
+
+        h = (NodeHandle)nodeKeys.size();
+        nodeKeys.push_back(node);
+        handleIndex[node] = h;
+        adjList.push_back(vector<Edge>());
+
+        stamp.push_back(0);
+        dist.push_back(infinity());
+        parent.push_back(-1);
+        stampB.push_back(0);
+        distB.push_back(infinity());
+        parentB.push_back(-1);
+        bannedStamp.push_back(0);
+        return h;
+    }
+
+    // Start a new query: every node reads as unvisited without clearing arrays
+    void beginQuery() {
+        if (++epoch == 0) {
+            fill(stamp.begin(), stamp.end(), 0u);
+            fill(stampB.begin(), stampB.end(), 0u);
+            fill(bannedStamp.begin(), bannedStamp.end(), 0u);
+            epoch = 1;
+        }
+        if (heap.capacity() != (int)nodeKeys.size()) {
+            heap.reset((int)nodeKeys.size());
+            heapB.reset((int)nodeKeys.size());
+        } else {
+            heap.clear();
+            heapB.clear();
+        }
+    }
+
+    void touch(NodeHandle h) {
+        if (stamp[h] != epoch) {
+            stamp[h] = epoch;
+            dist[h] = infinity();
+            parent[h] = -1;
+        }
+    }
+
+    void touchB(NodeHandle h) {
+        if (stampB[h] != epoch) {
+            stampB[h] = epoch;
+            distB[h] = infinity();
+            parentB[h] = -1;
+        }
+    }
+
+    bool isBanned(NodeHandle from, NodeHandle to) const {
+        if (bannedStamp[to] == epoch) return true;
+        if (from == bannedSpurNode) {
+            for (size_t i = 0; i < bannedSpurEdges.size(); i++) {
+                if (bannedSpurEdges[i] == to) return true;
+            }
+        }
+        return false;
+    }
+
+    WeightT heuristic(NodeHandle h, NodeHandle target) const {
+        WeightT best = WeightT();
+        for (size_t i = 0; i < landmarkDist.size(); i++) {
+            WeightT a = landmarkDist[i][h];
+            WeightT b = landmarkDist[i][target];
+            if (a == infinity() || b == infinity()) continue;
+            WeightT diff = a > b ? a - b : b - a;
+            if (diff > best) best = diff;
+        }
+        return best;
+    }
+
+    // Dijkstra (or A* when useHeuristic) from source; target -1 settles all
+    // reachable nodes. Caller must call beginQuery() first.
+    WeightT search(NodeHandle source, NodeHandle target, bool useHeuristic) {
+        touch(source);
+        dist[source] = WeightT();
+        heap.pushOrDecrease(source, useHeuristic ? heuristic(source, target) : WeightT());
+
+        while (!heap.empty()) {
+            NodeHandle current = heap.pop();
+            if (current == target) return dist[target];
+
+            for (size_t i = 0; i < adjList[current].size(); i++) {
+                const Edge& e = adjList[current][i];
+                if (isBanned(current, e.target)) continue;
+
+                WeightT candidate = dist[current] + e.weight;
+                touch(e.target);
+                if (candidate < dist[e.target]) {
+                    dist[e.target] = candidate;
+                    parent[e.target] = current;
+                    WeightT priority = useHeuristic ? candidate + heuristic(e.target, target) : candidate;
+                    heap.pushOrDecrease(e.target, priority);
                 }
-                reverse(path.begin(), path.end());
-                return path;
             }
-            
+        }
+
+        return target == -1 ? WeightT() : infinity();
+    }
+
+    vector<NodeHandle> tracePath(NodeHandle target) const {
+        vector<NodeHandle> path;
+        for (NodeHandle h = target; h != -1; h = parent[h]) {
+            path.push_back(h);
+        }
+        reverse(path.begin(), path.end());
+        return path;
+    }
+
+    vector<NodeT> toNodes(const vector<NodeHandle>& handles) const {
+        vector<NodeT> nodes;
+        nodes.reserve(handles.size());
+        for (size_t i = 0; i < handles.size(); i++) {
+            nodes.push_back(nodeKeys[handles[i]]);
+        }
+        return nodes;
+    }
+
+    WeightT edgeWeight(NodeHandle from, NodeHandle to) const {
+        WeightT best = infinity();
+        for (size_t i = 0; i < adjList[from].size(); i++) {
+            if (adjList[from][i].target == to && adjList[from][i].weight < best) {
+                best = adjList[from][i].weight;
+            }
+        }
+        return best;
+    }
+
+    // Farthest-point landmark selection, one full Dijkstra per landmark
+    void buildLandmarks() {
+        landmarkDist.clear();
+        landmarksDirty = false;
+        int n = (int)nodeKeys.size();
+        if (n == 0) return;
+
+        vector<WeightT> closest(n, infinity());
+        NodeHandle next = 0;
+        for (int k = 0; k < LANDMARK_COUNT && k < n; k++) {
+            beginQuery();
+            search(next, -1, false);
+
+            vector<WeightT> fromLandmark(n, infinity());
+            for (int h = 0; h < n; h++) {
+                if (stamp[h] == epoch) fromLandmark[h] = dist[h];
+            }
+            landmarkDist.push_back(fromLandmark);
+
+            WeightT farthest = WeightT();
+            for (int h = 0; h < n; h++) {
+                if (fromLandmark[h] < closest[h]) closest[h] = fromLandmark[h];
+                if (closest[h] != infinity() && closest[h] > farthest) {
+                    farthest = closest[h];
+                    next = h;
+                }
+            }
+            if (farthest == WeightT()) break;
+        }
+    }
+
+    void dfsVisit(NodeHandle h, set<NodeT>& visited) {
+        for (size_t i = 0; i < adjList[h].size(); i++) {
+            const NodeT& neighbor = nodeKeys[adjList[h][i].target];
+            if (visited.find(neighbor) == visited.end()) {
+                visited.insert(neighbor);
+                cout << neighbor << " -> ";
+                dfsVisit(adjList[h][i].target, visited);
+            }
+        }
+    }
+
+public:
+    BasicNetworkGraph() : epoch(0), bannedSpurNode(-1), landmarksDirty(true) {}
+
+    int nodeCount() const { return (int)nodeKeys.size(); }
+    const vector<NodeT>& nodes() const { return nodeKeys; }
+    bool contains(const NodeT& node) const { return handleOf(node) != -1; }
+
+    void addEdge(const NodeT& from, const NodeT& to, WeightT weight = WeightT(1)) {
+        NodeHandle a = addNode(from);
+        NodeHandle b = addNode(to);
+        adjList[a].push_back(Edge(b, weight));
+        adjList[b].push_back(Edge(a, weight));
+        landmarksDirty = true;
+    }
+
+    // BFS - Find shortest path (fewest hops)
+    vector<NodeT> bfsPath(const NodeT& start, const NodeT& end) {
+        NodeHandle s = handleOf(start);
+        NodeHandle t = handleOf(end);
+        if (s == -1 || t == -1) return vector<NodeT>();
+
+        beginQuery();
+        frontier.clear();
+        frontier.push_back(s);
+        touch(s);
+
+        for (size_t head = 0; head < frontier.size(); head++) {
+            NodeHandle current = frontier[head];
+            if (current == t) return toNodes(tracePath(t));
+
             for (size_t i = 0; i < adjList[current].size(); i++) {
-                string neighbor = adjList[current][i].target;
-                if (!visited[neighbor]) {
-                    visited[neighbor] = true;
+                NodeHandle neighbor = adjList[current][i].target;
+                if (stamp[neighbor] != epoch) {
+                    touch(neighbor);
                     parent[neighbor] = current;
-                    q.push(neighbor);
+                    frontier.push_back(neighbor);
                 }
             }
         }
-        
-        return vector<string>(); // No path found
+
+        return vector<NodeT>(); // No path found
     }
-    
+
     // DFS - Network exploration
-    void dfs(string start, set<string>& visited) {
+    void dfs(const NodeT& start, set<NodeT>& visited) {
         visited.insert(start);
         cout << start << " -> ";
-        
-        for (size_t i = 0; i < adjList[start].size(); i++) {
-            string neighbor = adjList[start][i].target;
-            if (visited.find(neighbor) == visited.end()) {
-                dfs(neighbor, visited);
+
+        NodeHandle h = handleOf(start);
+        if (h != -1) dfsVisit(h, visited);
+    }
+
+    // Dijkstra - Find shortest weighted path (-1 if none)
+    WeightT dijkstra(const NodeT& start, const NodeT& end) {
+        return bidirectionalDijkstra(start, end, NULL);
+    }
+
+    // Bidirectional Dijkstra - grows searches from both ends until they meet
+    WeightT bidirectionalDijkstra(const NodeT& start, const NodeT& end, vector<NodeT>* pathOut) {
+        NodeHandle s = handleOf(start);
+        NodeHandle t = handleOf(end);
+        if (s == -1 || t == -1) return WeightT(-1);
+
+        beginQuery();
+        touch(s);
+        touchB(t);
+        dist[s] = WeightT();
+        distB[t] = WeightT();
+        heap.pushOrDecrease(s, WeightT());
+        heapB.pushOrDecrease(t, WeightT());
+
+        WeightT best = s == t ? WeightT() : infinity();
+        NodeHandle meet = s == t ? s : -1;
+
+        while (!heap.empty() && !heapB.empty()) {
+            if (best != infinity() && heap.topKey() + heapB.topKey() >= best) break;
+
+            bool forward = heap.size() <= heapB.size();
+            NodeHandle current = forward ? heap.pop() : heapB.pop();
+
+            for (size_t i = 0; i < adjList[current].size(); i++) {
+                const Edge& e = adjList[current][i];
+                if (forward) {
+                    WeightT candidate = dist[current] + e.weight;
+                    touch(e.target);
+                    if (candidate < dist[e.target]) {
+                        dist[e.target] = candidate;
+                        parent[e.target] = current;
+                        heap.pushOrDecrease(e.target, candidate);
+                    }
+                    if (stampB[e.target] == epoch && distB[e.target] != infinity() &&
+                        candidate + distB[e.target] < best) {
+                        best = candidate + distB[e.target];
+                        meet = e.target;
+                    }
+                } else {
+                    WeightT candidate = distB[current] + e.weight;
+                    touchB(e.target);
+                    if (candidate < distB[e.target]) {
+                        distB[e.target] = candidate;
+                        parentB[e.target] = current;
+                        heapB.pushOrDecrease(e.target, candidate);
+                    }
+                    if (stamp[e.target] == epoch && dist[e.target] != infinity() &&
+                        candidate + dist[e.target] < best) {
+                        best = candidate + dist[e.target];
+                        meet = e.target;
+                    }
+                }
             }
         }
-    }
-    
-    // Dijkstra - Find shortest weighted path
-    int dijkstra(string start, string end) {
-        map<string, int> dist;
-        map<string, bool> visited;
-        priority_queue<pair<int, string>, vector<pair<int, string> >, greater<pair<int, string> > > pq;
-        
-        // Initialize distances
-        for (map<string, vector<Edge> >::iterator it = adjList.begin(); it != adjList.end(); ++it) {
-            dist[it->first] = 999999;
-        }
-        dist[start] = 0;
-        pq.push(make_pair(0, start));
-        
-        while (!pq.empty()) {
-            string current = pq.top().second;
-            pq.pop();
-            
-            if (visited[current]) continue;
-            visited[current] = true;
-            
-            if (current == end) {
-                return dist[end];
+
+        if (meet == -1) return WeightT(-1); // No path
+
+        if (pathOut) {
+            vector<NodeHandle> path = tracePath(meet);
+            for (NodeHandle h = parentB[meet]; h != -1; h = parentB[h]) {
+                path.push_back(h);
             }
-            
-            for (size_t i = 0; i < adjList[current].size(); i++) {
-                string neighbor = adjList[current][i].target;
-                int weight = adjList[current][i].weight;
-                
-                if (dist[current] + weight < dist[neighbor]) {
-                    dist[neighbor] = dist[current] + weight;
-                    pq.push(make_pair(dist[neighbor], neighbor));
+            *pathOut = toNodes(path);
+        }
+        return best;
+    }
+
+    // A* - Landmark (ALT) latency heuristic, rebuilt lazily after topology changes
+    WeightT aStar(const NodeT& start, const NodeT& end, vector<NodeT>* pathOut) {
+        NodeHandle s = handleOf(start);
+        NodeHandle t = handleOf(end);
+        if (s == -1 || t == -1) return WeightT(-1);
+
+        if (landmarksDirty) buildLandmarks();
+
+        beginQuery();
+        WeightT cost = search(s, t, true);
+        if (cost == infinity()) return WeightT(-1);
+
+        if (pathOut) *pathOut = toNodes(tracePath(t));
+        return cost;
+    }
+
+    // Yen's algorithm - k loopless shortest paths, cheapest first
+    vector<Path> kShortestPaths(const NodeT& start, const NodeT& end, int k) {
+        vector<Path> result;
+        NodeHandle s = handleOf(start);
+        NodeHandle t = handleOf(end);
+        if (s == -1 || t == -1 || k <= 0) return result;
+
+        vector<vector<NodeHandle> > accepted;
+        vector<WeightT> acceptedCost;
+        set<pair<WeightT, vector<NodeHandle> > > candidates;
+
+        beginQuery();
+        WeightT firstCost = search(s, t, false);
+        if (firstCost == infinity()) return result;
+        accepted.push_back(tracePath(t));
+        acceptedCost.push_back(firstCost);
+
+        while ((int)accepted.size() < k) {
+            const vector<NodeHandle> prev = accepted.back();
+            WeightT rootCost = WeightT();
+
+            for (size_t j = 0; j + 1 < prev.size(); j++) {
+                NodeHandle spur = prev[j];
+
+                beginQuery();
+                bannedSpurNode = spur;
+                bannedSpurEdges.clear();
+                for (size_t a = 0; a < accepted.size(); a++) {
+                    if (accepted[a].size() > j + 1 &&
+                        equal(prev.begin(), prev.begin() + j + 1, accepted[a].begin())) {
+                        bannedSpurEdges.push_back(accepted[a][j + 1]);
+                    }
+                }
+                for (size_t r = 0; r < j; r++) {
+                    bannedStamp[prev[r]] = epoch;
                 }
+
+                WeightT spurCost = search(spur, t, false);
+                if (spurCost != infinity()) {
+                    vector<NodeHandle> candidate(prev.begin(), prev.begin() + j);
+                    vector<NodeHandle> spurPath = tracePath(t);
+                    candidate.insert(candidate.end(), spurPath.begin(), spurPath.end());
+                    if (find(accepted.begin(), accepted.end(), candidate) == accepted.end()) {
+                        candidates.insert(make_pair(rootCost + spurCost, candidate));
+                    }
+                }
+
+                rootCost = rootCost + edgeWeight(prev[j], prev[j + 1]);
             }
+
+            bannedSpurNode = -1;
+            bannedSpurEdges.clear();
+            beginQuery(); // drops the node bans
+
+            if (candidates.empty()) break;
+            accepted.push_back(candidates.begin()->second);
+            acceptedCost.push_back(candidates.begin()->first);
+            candidates.erase(candidates.begin());
+        }
+
+        for (size_t i = 0; i < accepted.size(); i++) {
+            Path p;
+            p.cost = acceptedCost[i];
+            p.nodes = toNodes(accepted[i]);
+            result.push_back(p);
         }
-        
-        return -1; // No path
+        return result;
     }
-    
+
+    // Batch single-source query - one Dijkstra answers every target (-1 if unreachable)
+    vector<WeightT> latenciesFrom(const NodeT& source, const vector<NodeT>& targets) {
+        vector<WeightT> result(targets.size(), WeightT(-1));
+        NodeHandle s = handleOf(source);
+        if (s == -1) return result;
+
+        beginQuery();
+        search(s, -1, false);
+
+        for (size_t i = 0; i < targets.size(); i++) {
+            NodeHandle h = handleOf(targets[i]);
+            if (h != -1 && stamp[h] == epoch && dist[h] != infinity()) {
+                result[i] = dist[h];
+            }
+        }
+        return result;
+    }
+
     void displayConnections() {
         cout << "\n=== NETWORK CONNECTIONS ===\n";
-        for (map<string, vector<Edge> >::iterator it = adjList.begin(); it != adjList.end(); ++it) {
+        for (typename map<NodeT, NodeHandle>::const_iterator it = handleIndex.begin(); it != handleIndex.end(); ++it) {
             cout << it->first << " -> ";
-            for (size_t i = 0; i < it->second.size(); i++) {
-                cout << it->second[i].target << "(" << it->second[i].weight << "ms) ";
+            const vector<Edge>& edges = adjList[it->second];
+            for (size_t i = 0; i < edges.size(); i++) {
+                cout << nodeKeys[edges[i].target] << "(" << edges[i].weight << "ms) ";
             }
             cout << "\n";
         }
     }
 };
 
+typedef BasicNetworkGraph<string, int> NetworkGraph;
+
 #endif // NETWORK_GRAPH_H
\ No newline at end of file
@@ -0,0 +1,57 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <vector>
+using namespace std;
+
+// ============================================================================
+// FIXED-CAPACITY RING BUFFER FOR RECENT HISTORY
+// ============================================================================
+// Storage is allocated once in the constructor. Once full, push() overwrites
+// the oldest slot in place, so insertion is O(1) and never shifts or copies
+// the rest of the history. Every pushed item gets a sequence number
+// (0, 1, 2, ...) that stays valid until the item is overwritten.
+
+template <typename T>
+class RingBuffer {
+private:
+    vector<T> slots;
+    unsigned long long total; // items ever pushed = next sequence number
+
+public:
+    RingBuffer(int cap = 1) : slots(cap > 0 ? cap : 1), total(0) {}
+
+    void push(const T& item) {
+        slots[total % slots.size()] = item;
+        total++;
+    }
+
+    int capacity() const { return (int)slots.size(); }
+    int size() const { return total < slots.size() ? (int)total : (int)slots.size(); }
+    bool empty() const { return total == 0; }
+    bool full() const { return total >= slots.size(); }
+    void clear() { total = 0; }
+
+    // i = 0 is the newest item, i = size() - 1 the oldest
+    const T& recent(int i) const {
+        return slots[(total - 1 - i) % slots.size()];
+    }
+
+    // i = 0 is the oldest item, i = size() - 1 the newest
+    const T& operator[](int i) const {
+        return slots[(total - size() + i) % slots.size()];
+    }
+
+    unsigned long long nextSequence() const { return total; }
+
+    // True while the item with this sequence number has not been overwritten
+    bool holds(unsigned long long seq) const {
+        return seq < total && total - seq <= slots.size();
+    }
+
+    const T& atSequence(unsigned long long seq) const {
+        return slots[seq % slots.size()];
+    }
+};
+
+#endif // RING_BUFFER_H
@@ -0,0 +1,78 @@
+#ifndef SEVERITY_INDEX_H
+#define SEVERITY_INDEX_H
+
+#include <vector>
+#include <cstddef>
+#include "RingBuffer.h"
+using namespace std;
+
+// ============================================================================
+// SEVERITY-BUCKETED INDEX OVER A RECENT-EVENTS WINDOW
+// ============================================================================
+// Events live in one RingBuffer, so the window keeps the newest `capacity`
+// events and drops them oldest first. Each severity level has its own ring
+// of sequence numbers pointing into that window. Insertion is O(1). A top-N
+// query walks the levels from most to least severe, newest first within a
+// level, and touches only the N events it returns.
+
+template <typename T>
+class SeverityIndex {
+private:
+    RingBuffer<T> events;
+    vector<RingBuffer<unsigned long long> > buckets; // level -> event sequence numbers
+
+public:
+    SeverityIndex(int capacity, int levels)
+        : events(capacity), buckets(levels > 0 ? levels : 1, RingBuffer<unsigned long long>(capacity)) {}
+
+    // Severity is clamped to [0, levels - 1]
+    void push(int severity, const T& item) {
+        if (severity < 0) severity = 0;
+        if (severity >= (int)buckets.size()) severity = (int)buckets.size() - 1;
+
+        buckets[severity].push(events.nextSequence());
+        events.push(item);
+    }
+
+    int size() const { return events.size(); }
+    int capacity() const { return events.capacity(); }
+    int levels() const { return (int)buckets.size(); }
+    const RingBuffer<T>& recent() const { return events; }
+
+    // Walks events most severe first, newest first within a severity
+    class Cursor {
+    private:
+        const SeverityIndex* index;
+        int level;
+        int offset;
+
+    public:
+        Cursor(const SeverityIndex* idx) : index(idx), level(idx->levels() - 1), offset(0) {}
+
+        // Returns NULL once every event in the window has been visited
+        const T* next() {
+            while (level >= 0) {
+                const RingBuffer<unsigned long long>& bucket = index->buckets[level];
+                if (offset < bucket.size()) {
+                    unsigned long long seq = bucket.recent(offset);
+                    // Older entries in this bucket have left the window too
+                    if (index->events.holds(seq)) {
+                        offset++;
+                        return &index->events.atSequence(seq);
+                    }
+                }
+                level--;
+                offset = 0;
+            }
+            return NULL;
+        }
+
+        int severity() const { return level; }
+    };
+
+    friend class Cursor;
+
+    Cursor top() const { return Cursor(this); }
+};
+
+#endif // SEVERITY_INDEX_H